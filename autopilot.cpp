@@ -0,0 +1,92 @@
+/*
+####################################################################
+# TIE-02201 Ohjelmointi 2: Perusteet, K2019                        #
+# TIE-02207 Programming 2: Basics, S2019                           #
+#                                                                  #
+# Project4: Snake                                                  #
+#                                                                  #
+# File: autopilot.cpp                                              #
+# Description: Defines a class steering the Snake automatically.   #
+#                                                                  #
+# Author: Timo Hartikainen, timo.hartikainen@tuni.fi               #
+####################################################################
+*/
+
+#include "autopilot.hh"
+#include <algorithm>
+#include <cstdlib>
+
+const Direction DIRECTIONS[] = {Direction::UP, Direction::RIGHT,
+                                Direction::DOWN, Direction::LEFT};
+
+Autopilot::Autopilot(Policy policy, unsigned seed):
+    policy_(policy), rng_(seed) {
+}
+
+void Autopilot::steer(SnakeEngine& engine) {
+    Direction choices[4];
+    int choice_count = 0;
+
+    // Collect directions which don't end the game right away
+    for (Direction dir : DIRECTIONS) {
+        if (dir == opposite(engine.direction()))
+            continue;
+
+        if (isSafe(engine, engine.neighbour(engine.head(), dir)))
+            choices[choice_count++] = dir;
+    }
+
+    if (choice_count == 0)
+        return; // Trapped, keep going
+
+    if (policy_ == Policy::RANDOM) {
+        engine.setDirection(choices[rng_() % choice_count]);
+        return;
+    }
+
+    // Head for the food, earlier directions win ties
+    Direction best = choices[0];
+    int best_distance = distance(engine,
+                                 engine.neighbour(engine.head(), best),
+                                 engine.food());
+    for (int i = 1; i < choice_count; i++) {
+        int d = distance(engine, engine.neighbour(engine.head(), choices[i]),
+                         engine.food());
+        if (d < best_distance) {
+            best = choices[i];
+            best_distance = d;
+        }
+    }
+
+    engine.setDirection(best);
+}
+
+std::string Autopilot::policyName(Policy policy) {
+    switch (policy) {
+        case Policy::RANDOM:
+            return "random";
+        case Policy::GREEDY:
+            return "greedy";
+        default:
+            return "unknown";
+    }
+}
+
+bool Autopilot::isSafe(const SnakeEngine& engine, const Cell& cell) {
+    if (!engine.isOccupied(cell))
+        return true;
+
+    // Head may always follow the tail
+    return cell == engine.tail();
+}
+
+int Autopilot::distance(const SnakeEngine& engine, const Cell& from,
+                        const Cell& to) {
+    const int width = engine.rules().width;
+    const int height = engine.rules().height;
+
+    int d_x = abs(to.x - from.x);
+    int d_y = abs(to.y - from.y);
+
+    return std::min(d_x, width - d_x) + std::min(d_y, height - d_y);
+}
@@ -0,0 +1,87 @@
+/*
+####################################################################
+# TIE-02201 Ohjelmointi 2: Perusteet, K2019                        #
+# TIE-02207 Programming 2: Basics, S2019                           #
+#                                                                  #
+# Project4: Snake                                                  #
+#                                                                  #
+# File: autopilot.hh                                               #
+# Description: Declares a class steering the Snake automatically.  #
+#                                                                  #
+# Author: Timo Hartikainen, timo.hartikainen@tuni.fi               #
+####################################################################
+*/
+
+#ifndef PRG2_SNAKE2_AUTOPILOT_HH
+#define PRG2_SNAKE2_AUTOPILOT_HH
+
+#include "snake_engine.hh"
+#include <random>
+#include <string>
+
+/* \enum Policy
+ * \brief Ways for the autopilot to pick directions.
+ */
+enum class Policy {
+    RANDOM,                             /**< Any direction that is safe. */
+    GREEDY                              /**< Safe direction closest to food. */
+};
+
+/* \class Autopilot
+ * \brief Steers the Snake of a SnakeEngine without a player.
+ */
+class Autopilot {
+
+public:
+
+    /* \brief Construct an Autopilot.
+     *
+     * \param[in] policy Way to pick directions.
+     * \param[in] seed Random number generator seed.
+     */
+    Autopilot(Policy policy, unsigned seed);
+
+    /* \brief Turn the Snake before its next move.
+     *
+     * \param[in,out] engine Game to steer.
+     */
+    void steer(SnakeEngine& engine);
+
+    /* \brief Get the name of a policy.
+     *
+     * \param[in] policy Policy to name.
+     *
+     * \return Policy name used in reports.
+     */
+    static std::string policyName(Policy policy);
+
+
+private:
+
+    /* \brief Check if moving to a square keeps the Snake alive.
+     *
+     * \param[in] engine Game being steered.
+     * \param[in] cell Square the head would move to.
+     *
+     * \return True if the square is free or the tail is there.
+     */
+    static bool isSafe(const SnakeEngine& engine, const Cell& cell);
+
+    /* \brief Calculate the shortest distance between squares.
+     *
+     * \param[in] engine Game being steered.
+     * \param[in] from Starting square.
+     * \param[in] to Destination square.
+     *
+     * \return Number of moves, crossing walls if it is shorter.
+     */
+    static int distance(const SnakeEngine& engine, const Cell& from,
+                        const Cell& to);
+
+    Policy policy_;                     /**< Way to pick directions. */
+    std::mt19937 rng_;                  /**< Randomizes directions. */
+
+};  // class Autopilot
+
+
+#endif  // PRG2_SNAKE2_AUTOPILOT_HH
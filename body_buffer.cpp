@@ -0,0 +1,94 @@
+/*
+####################################################################
+# TIE-02201 Ohjelmointi 2: Perusteet, K2019                        #
+# TIE-02207 Programming 2: Basics, S2019                           #
+#                                                                  #
+# Project4: Snake                                                  #
+#                                                                  #
+# File: body_buffer.cpp                                            #
+# Description: Defines a ring buffer of packed square indices      #
+#              holding the snake parts.                            #
+#                                                                  #
+# Author: Timo Hartikainen, timo.hartikainen@tuni.fi               #
+####################################################################
+*/
+
+#include "body_buffer.hh"
+#include <algorithm>
+
+BodyBuffer::BodyBuffer(std::size_t cell_count):
+    index_bytes_(cell_count <= 65536 ? 2 : 4), max_capacity_(cell_count) {
+}
+
+void BodyBuffer::clear() {
+    head_ = 0;
+    size_ = 0;
+}
+
+void BodyBuffer::pushFront(std::uint32_t cell) {
+    if (size_ == capacity_)
+        grow();
+
+    // Head moves backwards in storage, tail stays put
+    head_ = head_ ? head_ - 1 : capacity_ - 1;
+    write(head_, cell);
+    size_ += 1;
+}
+
+void BodyBuffer::popBack() {
+    size_ -= 1;
+}
+
+std::uint32_t BodyBuffer::at(std::size_t index) const {
+    std::size_t slot = head_ + index;
+    if (slot >= capacity_)
+        slot -= capacity_;
+
+    return read(slot);
+}
+
+std::size_t BodyBuffer::storageBytes() const {
+    return data_.size();
+}
+
+void BodyBuffer::grow() {
+    // Grow by half, a full field never needs more than a slot per square
+    std::size_t new_capacity = std::min(capacity_ + capacity_ / 2 + 1,
+                                        max_capacity_);
+    new_capacity = std::max(new_capacity, size_ + 1);
+
+    std::vector<unsigned char> data(new_capacity * index_bytes_);
+
+    // Copy parts from head to the end of storage, then the wrapped rest
+    const std::size_t first = std::min(size_, capacity_ - head_);
+    auto head = data_.begin() + head_ * index_bytes_;
+    std::copy(head, head + first * index_bytes_, data.begin());
+    std::copy(data_.begin(), data_.begin() + (size_ - first) * index_bytes_,
+              data.begin() + first * index_bytes_);
+
+    data_.swap(data);
+    capacity_ = new_capacity;
+    head_ = 0;
+}
+
+std::uint32_t BodyBuffer::read(std::size_t slot) const {
+    const unsigned char* bytes = &data_[slot * index_bytes_];
+
+    // Least significant byte first
+    std::uint32_t cell = bytes[0] | (std::uint32_t)bytes[1] << 8;
+    if (index_bytes_ == 4)
+        cell |= (std::uint32_t)bytes[2] << 16 | (std::uint32_t)bytes[3] << 24;
+
+    return cell;
+}
+
+void BodyBuffer::write(std::size_t slot, std::uint32_t cell) {
+    unsigned char* bytes = &data_[slot * index_bytes_];
+
+    bytes[0] = (unsigned char)cell;
+    bytes[1] = (unsigned char)(cell >> 8);
+    if (index_bytes_ == 4) {
+        bytes[2] = (unsigned char)(cell >> 16);
+        bytes[3] = (unsigned char)(cell >> 24);
+    }
+}
@@ -0,0 +1,106 @@
+/*
+####################################################################
+# TIE-02201 Ohjelmointi 2: Perusteet, K2019                        #
+# TIE-02207 Programming 2: Basics, S2019                           #
+#                                                                  #
+# Project4: Snake                                                  #
+#                                                                  #
+# File: body_buffer.hh                                             #
+# Description: Declares a ring buffer of packed square indices     #
+#              holding the snake parts.                            #
+#                                                                  #
+# Author: Timo Hartikainen, timo.hartikainen@tuni.fi               #
+####################################################################
+*/
+
+#ifndef PRG2_SNAKE2_BODYBUFFER_HH
+#define PRG2_SNAKE2_BODYBUFFER_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/* \class BodyBuffer
+ * \brief Stores snake parts as square indices, head first.
+ *
+ * Indices are packed into a byte buffer, taking 2 bytes each when the
+ * game field has at most 65536 squares and 4 bytes otherwise. Storage
+ * grows by half when full, never beyond one slot per square, and is kept
+ * when the buffer is cleared, so moving the Snake never allocates.
+ */
+class BodyBuffer {
+
+public:
+
+    /* \brief Construct an empty BodyBuffer.
+     *
+     * \param[in] cell_count Number of squares in the game field.
+     */
+    explicit BodyBuffer(std::size_t cell_count);
+
+    /* \brief Remove every part, keeping storage for the next game.
+     */
+    void clear();
+
+    /* \brief Add a new head.
+     *
+     * \param[in] cell Square index of the head.
+     */
+    void pushFront(std::uint32_t cell);
+
+    /* \brief Remove the tail.
+     */
+    void popBack();
+
+    /* \brief Get a snake part.
+     *
+     * \param[in] index Part number, 0 being the head.
+     *
+     * \return Square index of the part.
+     */
+    std::uint32_t at(std::size_t index) const;
+
+    std::uint32_t front() const { return at(0); }
+    std::uint32_t back() const { return at(size_ - 1); }
+    std::size_t size() const { return size_; }
+    int indexBytes() const { return index_bytes_; }
+
+    /* \brief Get the memory reserved for parts.
+     *
+     * \return Bytes of storage, including unused slots.
+     */
+    std::size_t storageBytes() const;
+
+
+private:
+
+    /* \brief Enlarge storage, moving parts to the start.
+     */
+    void grow();
+
+    /* \brief Read the index stored in a slot.
+     *
+     * \param[in] slot Storage slot.
+     *
+     * \return Square index.
+     */
+    std::uint32_t read(std::size_t slot) const;
+
+    /* \brief Write an index to a slot.
+     *
+     * \param[in] slot Storage slot.
+     * \param[in] cell Square index.
+     */
+    void write(std::size_t slot, std::uint32_t cell);
+
+    std::vector<unsigned char> data_ = {}; /**< Packed slots. */
+    int index_bytes_ = 2;               /**< Bytes taken by an index. */
+    std::size_t max_capacity_ = 0;      /**< Number of squares. */
+    std::size_t capacity_ = 0;          /**< Number of slots. */
+    std::size_t head_ = 0;              /**< Slot of the head. */
+    std::size_t size_ = 0;              /**< Number of parts. */
+
+};  // class BodyBuffer
+
+
+#endif  // PRG2_SNAKE2_BODYBUFFER_HH
@@ -13,10 +13,29 @@
 */
 
 #include "main_window.hh"
+#include "tournament.hh"
 #include <QApplication>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
 
 
 int main(int argc, char** argv) {
+    // Play a headless bot tournament instead when asked to
+    for (int i = 1; i < argc; i++) {
+        if (argv[i] != TOURNAMENT_ARGUMENT)
+            continue;
+
+        TournamentOptions options;
+        for (int j = 1; j + 1 < argc; j++) {
+            if (argv[j] == SEEDS_ARGUMENT)
+                options.seed_count = std::max(1, atoi(argv[j + 1]));
+        }
+
+        runTournament(options, std::cout);
+        return 0;
+    }
+
     QApplication a(argc, argv);
     MainWindow w;
     w.show();
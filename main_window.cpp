@@ -56,20 +56,16 @@ void MainWindow::keyPressEvent(QKeyEvent* event) {
     switch (event->key())
     {
         case Qt::Key_W:
-            if (snake_dir_ != DIR_DOWN)
-                snake_dir_ = DIR_UP;
+            engine_.setDirection(Direction::UP);
             break;
         case Qt::Key_D:
-            if (snake_dir_ != DIR_LEFT)
-                snake_dir_ = DIR_RIGHT;
+            engine_.setDirection(Direction::RIGHT);
             break;
         case Qt::Key_S:
-            if (snake_dir_ != DIR_UP)
-                snake_dir_ = DIR_DOWN;
+            engine_.setDirection(Direction::DOWN);
             break;
         case Qt::Key_A:
-            if (snake_dir_ != DIR_RIGHT)
-                snake_dir_ = DIR_LEFT;
+            engine_.setDirection(Direction::LEFT);
             break;
     }
 }
@@ -101,6 +97,13 @@ void MainWindow::on_pauseButton_clicked() {
 }
 
 void MainWindow::startGame() {
+    // Start a new game in the engine
+    GameRules rules;
+    rules.width = FIELD_SIZE;
+    rules.height = FIELD_SIZE;
+    rules.level = level_;
+    engine_ = SnakeEngine(rules, rng_());
+
     // Initialize scene only once
     if (!snake_.size())
         adjustSceneArea();
@@ -119,13 +122,9 @@ void MainWindow::startGame() {
                               QBrush(Qt::yellow));
     wormhole_ = scene_.addEllipse(UNIT_RECTANGLE, QPen(Qt::white, 0),
                                   QBrush(Qt::black));
-    snake_.push_back(scene_.addEllipse(UNIT_RECTANGLE, QPen(Qt::white, 0),
-                                       QBrush(Qt::darkGreen)));
 
     // Place items
-    snake_.front()->setPos(SNAKE_START);
-    placeRandom(food_);
-    placeRandom(wormhole_);
+    updateScene(false);
 
     // Start game
     timer_.start(calculateSpeed());
@@ -139,11 +138,12 @@ void MainWindow::seedRandomNumberGenerator() {
     const auto elapsed = time_point_now.time_since_epoch();
     const auto secs = std::chrono::duration_cast<std::chrono::seconds>(elapsed);
 
-    std::default_random_engine rng_(secs.count());
+    rng_.seed(secs.count());
 }
 
 void MainWindow::adjustSceneArea() {
-    const QRectF area(0, 0, 100, 100);
+    const QRectF area(0, 0, engine_.rules().width * CELL_SIZE,
+                      engine_.rules().height * CELL_SIZE);
     scene_.setSceneRect(area);
     ui_.graphicsView->fitInView(area);
 
@@ -166,6 +166,8 @@ void MainWindow::deleteSceneObjects() {
 
     delete food_;
     delete wormhole_;
+    food_ = nullptr;
+    wormhole_ = nullptr;
 }
 
 void MainWindow::updateScoreTable() {
@@ -190,62 +192,23 @@ void MainWindow::updateScoreTable() {
 }
 
 void MainWindow::moveSnake() {
-    // Update position for the next possible piece (if food will be eaten)
-    last_tail_ = snake_.back()->scenePos();
-
-    // Store new positions temporarily (snake is animated once in the end)
-    std::vector<std::pair<QGraphicsEllipseItem*, QPointF>> temp_snake = {};
-    for (uint i=snake_.size()-1; i >= 1; i--) {
-        temp_snake.push_back({snake_.at(i), snake_.at(i - 1)->scenePos()});
-    }
-
-    // Move head first
-    QPointF old_head_pos = snake_.front()->scenePos();
-    QPointF new_head_pos = old_head_pos + snake_dir_;
-
-    // Cross walls
-    if (new_head_pos.x() > 95)
-        new_head_pos.setX(0);
-    else if (new_head_pos.x() < 0)
-        new_head_pos.setX(95);
-
-    if (new_head_pos.y() > 95)
-        new_head_pos.setY(0);
-    else if (new_head_pos.y() < 0)
-        new_head_pos.setY(95);
-
-    // Handle food and wormhole
-    if (old_head_pos == wormhole_->scenePos()) {
-        // Move head
-        placeRandom(snake_.front(), true);
-        new_head_pos = snake_.front()->scenePos();
-
-        // Change direction
-        snake_dir_ = getRandomDir();
+    TickResult result = engine_.tick();
 
-        // Move wormhole behind head
-        wormhole_->setPos(new_head_pos - snake_dir_);
+    // Leave the crashed snake where it was
+    if (result != TickResult::LOST)
+        updateScene();
 
-        // Check food
-        if (new_head_pos== food_->scenePos())
+    switch (result) {
+        case TickResult::ATE:
             eatFood();
-    } else {
-        // Check food
-        if (old_head_pos == food_->scenePos())
+            break;
+        case TickResult::WON:
             eatFood();
-
-        // Move head
-        animateMove(snake_.front(), new_head_pos);
-    }
-
-    // Move parts
-    for (auto part : temp_snake) {
-        animateMove(part.first, part.second);
-    }
-
-    // Check self-crossing
-    for (auto part : temp_snake) {
-        if (new_head_pos == part.second) {
+            on_playButton_clicked();
+            QMessageBox::information(0, WINDOW_TITLE,
+                                     "Congratulations! You Won!");
+            break;
+        case TickResult::LOST:
             // Stop game
             on_playButton_clicked();
 
@@ -256,10 +219,52 @@ void MainWindow::moveSnake() {
 
             // Display losing message
             QMessageBox::information(0, WINDOW_TITLE, "You Lost!");
-
             break;
+        default:
+            break;
+    }
+}
+
+void MainWindow::updateScene(bool animate) {
+    const uint old_size = snake_.size();
+
+    // Add pieces for new parts, color depends on part number only
+    while (snake_.size() < (uint)engine_.length()) {
+        snake_.push_back(scene_.addEllipse(UNIT_RECTANGLE, QPen(Qt::white, 0),
+                                           segmentBrush(snake_.size())));
+    }
+
+    for (uint i = 0; i < snake_.size(); i++) {
+        QGraphicsEllipseItem* piece = snake_.at(i);
+        const QPointF destination = cellToScene(engine_.segment(i));
+
+        if (!animate) {
+            piece->setPos(destination);
+        } else if (i >= old_size) {
+            // Animate adding
+            piece->setPos(getRandomCorner());
+            animateMove(piece, destination, true);
+        } else {
+            animateMove(piece, destination);
         }
     }
+
+    food_->setPos(cellToScene(engine_.food()));
+    wormhole_->setPos(cellToScene(engine_.wormhole()));
+    wormhole_->setVisible(engine_.rules().wormhole);
+}
+
+QPointF MainWindow::cellToScene(const Cell& cell) {
+    return QPointF(cell.x * CELL_SIZE, cell.y * CELL_SIZE);
+}
+
+QBrush MainWindow::segmentBrush(int index) {
+    if (index == 0)
+        return QBrush(Qt::darkGreen);
+
+    // Parts get lighter towards the tail
+    double piece_color = 200 * atan(index / 3.5) * 2 / M_PI;
+    return QBrush(QColor(piece_color, 255, piece_color));
 }
 
 void MainWindow::animateMove(QGraphicsEllipseItem* object, QPointF destination,
@@ -284,83 +289,15 @@ void MainWindow::animateMove(QGraphicsEllipseItem* object, QPointF destination,
 }
 
 void MainWindow::eatFood() {
-    // Calculate new piece color
-    double piece_color = 200 * atan(snake_.size() / 3.5) * 2 / M_PI;
-    const QBrush piece_brush(QColor(piece_color, 255, piece_color));
-
-    // Add to snake
-    snake_.push_back(scene_.addEllipse(UNIT_RECTANGLE, QPen(Qt::white, 0),
-                                       piece_brush));
-
-    // Animate adding
-    snake_.back()->setPos(getRandomCorner());
-    animateMove(snake_.back(), last_tail_, true);
-
     // Update score
-    score_ += 1;
+    score_ = engine_.score();
     ui_.scoreLcdNumber->display(score_);
 
-    // Check if snake fills the whole game field except wormhole
-    if (snake_.size() == 399) {
-        stopGame();
-        QMessageBox::information(0, WINDOW_TITLE, "Congratulations! You Won!");
-        return;
-    }
-
-    // Change food location
-    placeRandom(food_);
-
     // Update snake speed
     timer_.stop();
     timer_.start(calculateSpeed());
 }
 
-void MainWindow::placeRandom(QGraphicsEllipseItem* object,
-                             bool exclude_borders) {
-    std::uniform_int_distribution<int> int_dist;
-
-    if (exclude_borders)
-        int_dist = std::uniform_int_distribution<int>(1, 18);
-    else
-        int_dist = std::uniform_int_distribution<int>(0, 19);
-
-    // Find spare spots
-    while (true) {
-        bool skip_point = false;
-        QPointF new_pos = QPointF(int_dist(rng_) * 5, int_dist(rng_) * 5);
-
-        if (food_->scenePos() == new_pos || wormhole_->scenePos() == new_pos)
-            continue;
-
-        for (auto part : snake_) {
-            if (part->scenePos() == new_pos)
-                skip_point = true;
-        }
-
-        if (!skip_point) {
-            object->setPos(new_pos);
-            break;
-        }
-    }
-}
-
-QPointF MainWindow::getRandomDir() {
-    std::uniform_int_distribution<int> int_dist(1, 4);
-
-    switch (int_dist(rng_)) {
-        case 1:
-            return DIR_UP;
-        case 2:
-            return DIR_RIGHT;
-        case 3:
-            return DIR_DOWN;
-        case 4:
-            return DIR_LEFT;
-        default:
-            return DIR_UP;
-    }
-}
-
 QPointF MainWindow::getRandomCorner() {
     std::uniform_int_distribution<int> int_dist(1, 4);
 
@@ -384,7 +321,7 @@ void MainWindow::countClock() {
 }
 
 int MainWindow::calculateSpeed() {
-    return std::max((int)(speed_ * 0.5), speed_ - 20 * score_);
+    return engine_.tickInterval();
 }
 
 QString MainWindow::secondsToTime(int seconds) {
@@ -411,7 +348,6 @@ void MainWindow::on_scoretablePushButton_clicked() {
 
 void MainWindow::on_levelDial_sliderReleased() {
     level_ = ui_.levelDial->value();
-    speed_ = (5 - level_) * 225;
 }
 
 void MainWindow::on_levelDial_valueChanged(int value) {
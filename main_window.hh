@@ -16,6 +16,7 @@
 #define PRG2_SNAKE2_MAINWINDOW_HH
 
 #include "ui_main_window.h"
+#include "snake_engine.hh"
 #include <QMainWindow>
 #include <QCloseEvent>
 #include <QGraphicsScene>
@@ -39,15 +40,10 @@ const QString WINDOW_TITLE = "Snake 2"; /**< Window title for dialogs. */
 const int WINDOW_WIDTH_MIN = 622;       /**< Window width scoretable hidden. */
 const int WINDOW_WIDTH_MAX = 890;       /**< Window width scoretable visible. */
 
-const QPointF SNAKE_START = QPointF(45, 45);      /**< Snake start position. */
-const QRectF UNIT_RECTANGLE = QRectF(0, 0, 5, 5); /**< Game field
-                                                       unit rectangle. */
-
-// Unit displacement vectors.
-const QPointF DIR_UP = QPointF(0, -5);          /**< Snake direction up. */
-const QPointF DIR_RIGHT = QPointF(5, 0);        /**< Snake direction right. */
-const QPointF DIR_DOWN = QPointF(0, 5);         /**< Snake direction down. */
-const QPointF DIR_LEFT = QPointF(-5, 0);        /**< Snake direction left. */
+const int FIELD_SIZE = 20;              /**< Game field side in squares. */
+const qreal CELL_SIZE = 5;              /**< Game field square side length. */
+const QRectF UNIT_RECTANGLE = QRectF(0, 0, CELL_SIZE, CELL_SIZE); /**< Game
+                                                       field unit rectangle. */
 
 /* \class MainWindow
  * \brief Implements the main window through which the game is played.
@@ -98,7 +94,7 @@ private slots:
      */
     void on_instructionsButton_clicked();
 
-    /* \brief Calulate snake speed.
+    /* \brief Store selected level.
      */
     void on_levelDial_sliderReleased();
 
@@ -112,6 +108,7 @@ private slots:
      *
      * The game ends if the Snake gets in the way.
      * When a food gets eaten a point is gained and the Snake grows.
+     * Game rules are applied by the engine, the scene only mirrors it.
      */
     void moveSnake();
 
@@ -142,15 +139,33 @@ private:
     void animateMove(QGraphicsEllipseItem* object, QPointF destination,
                      bool ignore_distance = false);
 
-    /* \brief Place item randomly in game field.
+    /* \brief Move scene objects to match the engine state.
      *
-     * \param[in] object Scene object to be moved.
-     * \param[in] exclude_borders If true, object won't be placed near borders.
+     * The whole 20x20 field is always in view, so every snake part has a
+     * scene object. Objects are added as the Snake grows and reused
+     * between moves.
+     *
+     * \param[in] animate If false, objects jump to their squares.
+     */
+    void updateScene(bool animate = true);
+
+    /* \brief Convert a game field square to a scene point.
+     *
+     * \param[in] cell Square on the game field.
+     *
+     * \return Top left corner of the square in the scene.
      */
-    void placeRandom(QGraphicsEllipseItem* object,
-                     bool exclude_borders = false);
+    QPointF cellToScene(const Cell& cell);
 
-    /* \brief Increase snake length and place food again.
+    /* \brief Calculate snake part color from its position in the Snake.
+     *
+     * \param[in] index Part number, 0 being the head.
+     *
+     * \return Brush for the part.
+     */
+    QBrush segmentBrush(int index);
+
+    /* \brief Gain a point and speed up the Snake.
      */
     void eatFood();
 
@@ -184,12 +199,6 @@ private:
      */
     QString secondsToTime(int seconds);
 
-    /* \brief Get random snake direction.
-     *
-     * \return Randomly pointing unit displacement vector.
-     */
-    QPointF getRandomDir();
-
     /* \brief Get random corner location.
      *
      * \return Random corner location point.
@@ -198,14 +207,14 @@ private:
 
     Ui::MainWindow ui_;                 /**< Accesses the UI widgets. */
     QGraphicsScene scene_;              /**< Manages drawable objects. */
+    SnakeEngine engine_ = SnakeEngine(GameRules(), 0); /**< Applies game
+                                                            rules. */
     std::vector<QGraphicsEllipseItem*> snake_ = {}; /**< Contains snake
                                                          parts. */
     QGraphicsEllipseItem* food_ = nullptr;          /**< The food item in the
                                                          scene. */
     QGraphicsEllipseItem* wormhole_ = nullptr;      /**< The wormhole item in
                                                          the scene.  */
-    QPointF snake_dir_ = DIR_UP;        /**< Snake moving direction.  */
-    QPointF last_tail_ = SNAKE_START;   /**< Last snake tail piece location.  */
     QTimer timer_;                      /**< Triggers the Snake to move. */
     QTimer clock_timer_;                /**< Triggers game time to update. */
     std::default_random_engine rng_;    /**< Randomizes integers. */
@@ -213,7 +222,6 @@ private:
     int time_ = 0;                      /**< Contains game time in seconds. */
     int score_ = 0;                     /**< Contains game score. */
     int level_ = 1;                     /**< Contains game level. */
-    int speed_ = 900;                   /**< Contains snake speed. */
 
 };  // class MainWindow
 
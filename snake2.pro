@@ -24,12 +24,27 @@ DEFINES += QT_DEPRECATED_WARNINGS
 
 CONFIG += c++14
 
+# Count heap allocations for bot tournament reports (replaces global
+# operator new, so keep it out of normal builds).
+# Enable with: qmake CONFIG+=count_allocations
+count_allocations {
+    DEFINES += SNAKE2_COUNT_ALLOCATIONS
+}
+
 SOURCES += \
+        autopilot.cpp \
+        body_buffer.cpp \
         main.cpp \
-        main_window.cpp
+        main_window.cpp \
+        snake_engine.cpp \
+        tournament.cpp
 
 HEADERS += \
-        main_window.hh
+        autopilot.hh \
+        body_buffer.hh \
+        main_window.hh \
+        snake_engine.hh \
+        tournament.hh
 
 FORMS += \
     main_window.ui
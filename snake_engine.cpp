@@ -0,0 +1,287 @@
+/*
+####################################################################
+# TIE-02201 Ohjelmointi 2: Perusteet, K2019                        #
+# TIE-02207 Programming 2: Basics, S2019                           #
+#                                                                  #
+# Project4: Snake                                                  #
+#                                                                  #
+# File: snake_engine.cpp                                           #
+# Description: Defines a class implementing the game rules         #
+#              without any UI.                                     #
+#                                                                  #
+# Author: Timo Hartikainen, timo.hartikainen@tuni.fi               #
+####################################################################
+*/
+
+#include "snake_engine.hh"
+#include <algorithm>
+
+bool operator==(const Cell& lhs, const Cell& rhs) {
+    return lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
+bool operator!=(const Cell& lhs, const Cell& rhs) {
+    return !(lhs == rhs);
+}
+
+Direction opposite(Direction dir) {
+    return static_cast<Direction>((static_cast<int>(dir) + 2) % 4);
+}
+
+SnakeEngine::SnakeEngine(const GameRules& rules, unsigned seed):
+    rules_(rules), body_((std::size_t)rules.width * rules.height) {
+
+    reset(seed);
+}
+
+void SnakeEngine::reset(unsigned seed) {
+    rng_.seed(seed);
+
+    // Reset counters
+    body_.clear();
+    occupied_.assign((std::size_t)rules_.width * rules_.height, false);
+    dir_ = Direction::UP;
+    score_ = 0;
+    ticks_ = 0;
+    placements_ = 0;
+    placement_retries_ = 0;
+    stacked_parts_ = 0;
+
+    // Keep items off the field until they get placed
+    food_ = Cell{-1, -1};
+    wormhole_ = Cell{-1, -1};
+
+    // Place items
+    if (rules_.start_length > 1)
+        layLongSnake();
+    else
+        pushHead(Cell{(rules_.width - 1) / 2, (rules_.height - 1) / 2});
+    randomFreeCell(food_);
+    if (rules_.wormhole)
+        randomFreeCell(wormhole_);
+
+    active_ = true;
+}
+
+bool SnakeEngine::setDirection(Direction dir) {
+    // Snake can't turn back into itself
+    if (dir == opposite(dir_))
+        return false;
+
+    dir_ = dir;
+    return true;
+}
+
+TickResult SnakeEngine::tick() {
+    if (!active_)
+        return TickResult::LOST;
+
+    ticks_ += 1;
+
+    const Cell old_head = head();
+    Cell new_head;
+    bool ate = false;
+
+    // Handle food and wormhole
+    if (rules_.wormhole && old_head == wormhole_) {
+        // Move head
+        if (!randomFreeCell(new_head, true)) {
+            active_ = false;
+            return TickResult::LOST;
+        }
+
+        // Change direction
+        dir_ = static_cast<Direction>(randomInt(0, 3));
+
+        // Move wormhole behind head
+        wormhole_ = neighbour(new_head, opposite(dir_));
+
+        // Check food
+        ate = new_head == food_;
+    } else {
+        // Food gets eaten when the head leaves its square
+        ate = old_head == food_;
+        new_head = neighbour(old_head, dir_);
+    }
+
+    if (ate)
+        score_ += 1;
+
+    // The tail square counts as free even if the Snake grows into it
+    if (isOccupied(new_head) && toIndex(new_head) != body_.back()) {
+        active_ = false;
+        return TickResult::LOST;
+    }
+
+    // Food is placed before the Snake moves, so it may land in front of it
+    bool won = false;
+    if (ate)
+        won = isFieldFull() || !randomFreeCell(food_);
+
+    // New part is added where the tail was
+    if (!ate)
+        popTail();
+    pushHead(new_head);
+
+    if (won) {
+        active_ = false;
+        return TickResult::WON;
+    }
+
+    return ate ? TickResult::ATE : TickResult::MOVED;
+}
+
+int SnakeEngine::levelSpeed(int level) {
+    return (5 - level) * 225;
+}
+
+int SnakeEngine::tickInterval() const {
+    const int speed = levelSpeed(rules_.level);
+    return std::max((int)(speed * 0.5), speed - 20 * score_);
+}
+
+Cell SnakeEngine::neighbour(const Cell& cell, Direction dir) const {
+    Cell next = cell;
+
+    switch (dir) {
+        case Direction::UP:
+            next.y -= 1;
+            break;
+        case Direction::RIGHT:
+            next.x += 1;
+            break;
+        case Direction::DOWN:
+            next.y += 1;
+            break;
+        case Direction::LEFT:
+            next.x -= 1;
+            break;
+    }
+
+    // Cross walls
+    next.x = (next.x + rules_.width) % rules_.width;
+    next.y = (next.y + rules_.height) % rules_.height;
+
+    return next;
+}
+
+bool SnakeEngine::isOccupied(const Cell& cell) const {
+    return occupied_[toIndex(cell)];
+}
+
+Cell SnakeEngine::segment(int index) const {
+    return toCell(body_.at(index));
+}
+
+std::uint32_t SnakeEngine::toIndex(const Cell& cell) const {
+    return (std::uint32_t)cell.y * rules_.width + cell.x;
+}
+
+Cell SnakeEngine::toCell(std::uint32_t index) const {
+    return Cell{(int)(index % rules_.width), (int)(index / rules_.width)};
+}
+
+void SnakeEngine::pushHead(const Cell& cell) {
+    const std::uint32_t index = toIndex(cell);
+
+    if (occupied_[index])
+        stacked_parts_ += 1;
+
+    body_.pushFront(index);
+    occupied_[index] = true;
+}
+
+void SnakeEngine::layLongSnake() {
+    // Leave room for food and wormhole
+    const int cell_count = rules_.width * rules_.height;
+    const int length = std::min(rules_.start_length, cell_count - 2);
+
+    // Wind row by row from the top left corner, tail first
+    for (int i = 0; i < length; i++) {
+        const int row = i / rules_.width;
+        const int column = i % rules_.width;
+        pushHead(Cell{row % 2 ? rules_.width - 1 - column : column, row});
+    }
+
+    // Head away from the body
+    dir_ = Direction::DOWN;
+}
+
+void SnakeEngine::popTail() {
+    const std::uint32_t index = body_.back();
+    body_.popBack();
+
+    // Square stays taken if another part was stacked on it
+    if (stacked_parts_ > 0) {
+        for (std::size_t i = 0; i < body_.size(); i++) {
+            if (body_.at(i) == index) {
+                stacked_parts_ -= 1;
+                return;
+            }
+        }
+    }
+
+    occupied_[index] = false;
+}
+
+bool SnakeEngine::isFieldFull() const {
+    // Snake fills the whole game field except wormhole once it has grown
+    const int items = rules_.wormhole ? 1 : 0;
+    return length() + 1 + items >= rules_.width * rules_.height;
+}
+
+bool SnakeEngine::isFree(const Cell& cell) const {
+    return cell != food_ && cell != wormhole_ && !isOccupied(cell);
+}
+
+bool SnakeEngine::randomFreeCell(Cell& cell, bool exclude_borders) {
+    const int border = exclude_borders ? 1 : 0;
+    const int width = rules_.width - 2 * border;
+    const int height = rules_.height - 2 * border;
+
+    placements_ += 1;
+
+    if (width <= 0 || height <= 0)
+        return false;
+
+    // Try random spots first, they are cheap while the field is empty
+    for (int i = 0; i < width * height; i++) {
+        Cell candidate{border + randomInt(0, width - 1),
+                       border + randomInt(0, height - 1)};
+
+        if (isFree(candidate)) {
+            cell = candidate;
+            return true;
+        }
+
+        placement_retries_ += 1;
+    }
+
+    // Pick among the spare spots that are left
+    int spare_count = 0;
+    for (int y = border; y < border + height; y++) {
+        for (int x = border; x < border + width; x++) {
+            if (isFree(Cell{x, y}))
+                spare_count += 1;
+        }
+    }
+
+    if (spare_count == 0)
+        return false;
+
+    int spare = randomInt(0, spare_count - 1);
+    for (int y = border; y < border + height; y++) {
+        for (int x = border; x < border + width; x++) {
+            if (isFree(Cell{x, y}) && spare-- == 0) {
+                cell = Cell{x, y};
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+int SnakeEngine::randomInt(int min, int max) {
+    return min + (int)(rng_() % (unsigned)(max - min + 1));
+}
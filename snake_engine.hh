@@ -0,0 +1,268 @@
+/*
+####################################################################
+# TIE-02201 Ohjelmointi 2: Perusteet, K2019                        #
+# TIE-02207 Programming 2: Basics, S2019                           #
+#                                                                  #
+# Project4: Snake                                                  #
+#                                                                  #
+# File: snake_engine.hh                                            #
+# Description: Declares a class implementing the game rules        #
+#              without any UI.                                     #
+#                                                                  #
+# Author: Timo Hartikainen, timo.hartikainen@tuni.fi               #
+####################################################################
+*/
+
+#ifndef PRG2_SNAKE2_SNAKEENGINE_HH
+#define PRG2_SNAKE2_SNAKEENGINE_HH
+
+#include "body_buffer.hh"
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+const int LEVEL_MIN = 1;                /**< Slowest selectable level. */
+const int LEVEL_MAX = 4;                /**< Fastest selectable level. */
+
+/* \struct Cell
+ * \brief Location of a single game field square.
+ */
+struct Cell {
+    int x = 0;                          /**< Column index. */
+    int y = 0;                          /**< Row index. */
+};
+
+bool operator==(const Cell& lhs, const Cell& rhs);
+bool operator!=(const Cell& lhs, const Cell& rhs);
+
+/* \enum Direction
+ * \brief Snake moving directions.
+ */
+enum class Direction { UP, RIGHT, DOWN, LEFT };
+
+/* \brief Get the direction pointing the other way.
+ *
+ * \param[in] dir Direction to turn around.
+ *
+ * \return Opposite direction.
+ */
+Direction opposite(Direction dir);
+
+/* \enum TickResult
+ * \brief Outcome of a single snake move.
+ */
+enum class TickResult { MOVED, ATE, LOST, WON };
+
+/* \struct GameRules
+ * \brief Rule variant a game is played with.
+ */
+struct GameRules {
+    int width = 20;                     /**< Game field width in squares. */
+    int height = 20;                    /**< Game field height in squares. */
+    bool wormhole = true;               /**< Contains wormhole status. */
+    int level = LEVEL_MIN;              /**< Contains game level. */
+    int start_length = 1;               /**< Snake parts at game start. */
+};
+
+/* \class SnakeEngine
+ * \brief Implements the game rules on an integer grid.
+ *
+ * The engine is deterministic for a given seed so that games can be
+ * replayed and benchmarked without a UI. Snake parts are kept as packed
+ * square indices with a one bit occupancy plane beside them, so large
+ * fields stay small in memory.
+ */
+class SnakeEngine {
+
+public:
+
+    /* \brief Construct a SnakeEngine and start a new game.
+     *
+     * \param[in] rules Rule variant to play with.
+     * \param[in] seed Random number generator seed.
+     */
+    SnakeEngine(const GameRules& rules, unsigned seed);
+
+    /* \brief Start a new game with the same rules.
+     *
+     * \param[in] seed Random number generator seed.
+     */
+    void reset(unsigned seed);
+
+    /* \brief Change the Snake's bearing.
+     *
+     * \param[in] dir New direction.
+     *
+     * \return False if the direction would reverse the Snake.
+     */
+    bool setDirection(Direction dir);
+
+    /* \brief Move the Snake by a square and check for collisions.
+     *
+     * Food gets eaten when the head leaves its square and the new part is
+     * added where the tail was. The head may move into the square the tail
+     * is leaving even when the Snake grows.
+     *
+     * \return Outcome of the move.
+     */
+    TickResult tick();
+
+    /* \brief Calculate base speed of a level.
+     *
+     * \param[in] level Game level.
+     *
+     * \return Milliseconds between moves before any food is eaten.
+     */
+    static int levelSpeed(int level);
+
+    /* \brief Calculate current snake speed.
+     *
+     * \return Milliseconds between moves.
+     */
+    int tickInterval() const;
+
+    /* \brief Get the square next to a square, crossing walls.
+     *
+     * \param[in] cell Starting square.
+     * \param[in] dir Direction to step to.
+     *
+     * \return Neighbouring square.
+     */
+    Cell neighbour(const Cell& cell, Direction dir) const;
+
+    /* \brief Check if the Snake occupies a square.
+     *
+     * \param[in] cell Square to check.
+     *
+     * \return True if some snake part is in the square.
+     */
+    bool isOccupied(const Cell& cell) const;
+
+    /* \brief Get a snake part.
+     *
+     * \param[in] index Part number, 0 being the head.
+     *
+     * \return Square of the part.
+     */
+    Cell segment(int index) const;
+
+    /* \brief Get the memory holding the snake parts.
+     *
+     * \return Bytes reserved for part indices.
+     */
+    std::size_t bodyBytes() const { return body_.storageBytes(); }
+
+    /* \brief Get the memory of the occupancy plane.
+     *
+     * \return Bytes taken by one bit per square.
+     */
+    std::size_t occupancyBytes() const { return (occupied_.size() + 7) / 8; }
+
+    const GameRules& rules() const { return rules_; }
+    int length() const { return (int)body_.size(); }
+    Cell head() const { return toCell(body_.front()); }
+    Cell tail() const { return toCell(body_.back()); }
+    Cell food() const { return food_; }
+    Cell wormhole() const { return wormhole_; }
+    Direction direction() const { return dir_; }
+    bool isActive() const { return active_; }
+    int score() const { return score_; }
+    long long ticks() const { return ticks_; }
+    long long placements() const { return placements_; }
+    long long placementRetries() const { return placement_retries_; }
+
+
+private:
+
+    /* \brief Convert a square to its index.
+     *
+     * \param[in] cell Square on the game field.
+     *
+     * \return Row-major square index.
+     */
+    std::uint32_t toIndex(const Cell& cell) const;
+
+    /* \brief Convert an index to its square.
+     *
+     * \param[in] index Row-major square index.
+     *
+     * \return Square on the game field.
+     */
+    Cell toCell(std::uint32_t index) const;
+
+    /* \brief Add a new head to the Snake.
+     *
+     * \param[in] cell Square of the head.
+     */
+    void pushHead(const Cell& cell);
+
+    /* \brief Start the game with a Snake of GameRules::start_length parts.
+     *
+     * The Snake winds through the rows from the top left corner, which
+     * lets memory use be measured on long snakes without playing first.
+     */
+    void layLongSnake();
+
+    /* \brief Remove the tail of the Snake.
+     */
+    void popTail();
+
+    /* \brief Check if a grown Snake leaves no room for food.
+     *
+     * \return True if the Snake fills the field except the wormhole.
+     */
+    bool isFieldFull() const;
+
+    /* \brief Check if a square is free of snake parts and items.
+     *
+     * \param[in] cell Square to check.
+     *
+     * \return True if nothing is in the square.
+     */
+    bool isFree(const Cell& cell) const;
+
+    /* \brief Find a random square free of snake parts and items.
+     *
+     * Random squares are tried first. If they keep getting rejected, a
+     * spare square is picked directly so that a nearly full field can't
+     * stall the game.
+     *
+     * \param[out] cell Free square, untouched if none is found.
+     * \param[in] exclude_borders If true, squares next to walls are skipped.
+     *
+     * \return False if there are no free squares.
+     */
+    bool randomFreeCell(Cell& cell, bool exclude_borders = false);
+
+    /* \brief Draw a random integer.
+     *
+     * Unlike std::uniform_int_distribution, this gives the same sequence
+     * with every standard library.
+     *
+     * \param[in] min Smallest possible value.
+     * \param[in] max Largest possible value.
+     *
+     * \return Random integer from [min, max].
+     */
+    int randomInt(int min, int max);
+
+    GameRules rules_;                   /**< Rule variant in use. */
+    std::mt19937 rng_;                  /**< Randomizes integers. */
+    BodyBuffer body_;                   /**< Snake parts, head first. */
+    std::vector<bool> occupied_ = {};   /**< Squares taken by snake parts. */
+    Cell food_ = {};                    /**< Food location. */
+    Cell wormhole_ = {};                /**< Wormhole location. */
+    Direction dir_ = Direction::UP;     /**< Snake moving direction. */
+    bool active_ = false;               /**< Contains game status. */
+    int score_ = 0;                     /**< Contains game score. */
+    long long ticks_ = 0;               /**< Moves made this game. */
+    long long placements_ = 0;          /**< Random placements made. */
+    long long placement_retries_ = 0;   /**< Rejected random squares. */
+    int stacked_parts_ = 0;             /**< Parts sharing a square with
+                                             another part. */
+
+};  // class SnakeEngine
+
+
+#endif  // PRG2_SNAKE2_SNAKEENGINE_HH
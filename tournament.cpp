@@ -0,0 +1,259 @@
+/*
+####################################################################
+# TIE-02201 Ohjelmointi 2: Perusteet, K2019                        #
+# TIE-02207 Programming 2: Basics, S2019                           #
+#                                                                  #
+# Project4: Snake                                                  #
+#                                                                  #
+# File: tournament.cpp                                             #
+# Description: Defines a headless bot tournament producing a       #
+#              regression report.                                  #
+#                                                                  #
+# Author: Timo Hartikainen, timo.hartikainen@tuni.fi               #
+####################################################################
+*/
+
+#include "tournament.hh"
+#include "autopilot.hh"
+#include "snake_engine.hh"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+
+namespace {
+
+std::atomic<long long> allocation_count(0); /**< Heap allocations made by
+                                                 the whole program, counted
+                                                 only with
+                                                 SNAKE2_COUNT_ALLOCATIONS. */
+
+/* \struct RunResult
+ * \brief Totals of the games played with one policy and rule variant.
+ */
+struct RunResult {
+    int won = 0;                        /**< Games filling the field. */
+    int lost = 0;                       /**< Games ended by a collision. */
+    int timed_out = 0;                  /**< Games reaching tick limit. */
+    long long total_score = 0;          /**< Food eaten in all games. */
+    int max_score = 0;                  /**< Best single game score. */
+    long long total_ticks = 0;          /**< Moves made in all games. */
+    long long game_time_ms = 0;         /**< Play time at level speed. */
+    long long placements = 0;           /**< Random placements made. */
+    long long placement_retries = 0;    /**< Rejected random squares. */
+    long long allocations = 0;          /**< Heap allocations while moving. */
+    long long total_length = 0;         /**< Final snake lengths summed. */
+    long long body_bytes = 0;           /**< Final body storage summed. */
+    long long occupancy_bytes = 0;      /**< Occupancy planes summed. */
+    int max_length = 0;                 /**< Longest final snake. */
+    double seconds = 0;                 /**< Wall time spent moving. */
+};
+
+/* \brief Play the seeded games of one policy and rule variant.
+ *
+ * \param[in] policy Autopilot policy.
+ * \param[in] rules Rule variant.
+ * \param[in] options Game set to play.
+ *
+ * \return Totals of the games.
+ */
+RunResult playRun(Policy policy, const GameRules& rules,
+                  const TournamentOptions& options) {
+    RunResult result;
+
+    for (int seed = 1; seed <= options.seed_count; seed++) {
+        SnakeEngine engine(rules, seed);
+        Autopilot autopilot(policy, seed);
+        TickResult tick_result = TickResult::MOVED;
+
+        const long long allocations_before = allocation_count.load();
+        const auto start = std::chrono::steady_clock::now();
+
+        while (engine.isActive() && engine.ticks() < options.tick_limit) {
+            result.game_time_ms += engine.tickInterval();
+            autopilot.steer(engine);
+            tick_result = engine.tick();
+        }
+
+        const auto end = std::chrono::steady_clock::now();
+        result.allocations += allocation_count.load() - allocations_before;
+        result.seconds += std::chrono::duration<double>(end - start).count();
+
+        if (engine.isActive())
+            result.timed_out += 1;
+        else if (tick_result == TickResult::WON)
+            result.won += 1;
+        else
+            result.lost += 1;
+
+        result.total_score += engine.score();
+        result.max_score = std::max(result.max_score, engine.score());
+        result.total_ticks += engine.ticks();
+        result.placements += engine.placements();
+        result.placement_retries += engine.placementRetries();
+        result.total_length += engine.length();
+        result.body_bytes += engine.bodyBytes();
+        result.occupancy_bytes += engine.occupancyBytes();
+        result.max_length = std::max(result.max_length, engine.length());
+    }
+
+    return result;
+}
+
+/* \brief Write the report entry of one run.
+ *
+ * \param[in] policy Autopilot policy.
+ * \param[in] rules Rule variant.
+ * \param[in] result Totals of the games.
+ * \param[in] options Game set played.
+ * \param[out] out Stream the entry is written to.
+ */
+void writeRun(Policy policy, const GameRules& rules, const RunResult& result,
+              const TournamentOptions& options, std::ostream& out) {
+    const double ticks = std::max(1LL, result.total_ticks);
+    const double placements = std::max(1LL, result.placements);
+    const double segments = std::max(1LL, result.total_length);
+
+    out << "    {\n"
+        << "      \"policy\": \"" << Autopilot::policyName(policy) << "\",\n"
+        << "      \"level\": " << rules.level << ",\n"
+        << "      \"board\": \"" << rules.width << "x" << rules.height
+        << "\",\n"
+        << "      \"wormhole\": " << (rules.wormhole ? "true" : "false")
+        << ",\n"
+        << "      \"start_length\": " << rules.start_length << ",\n"
+        << "      \"outcome\": {\n"
+        << "        \"games\": " << options.seed_count << ",\n"
+        << "        \"won\": " << result.won << ",\n"
+        << "        \"lost\": " << result.lost << ",\n"
+        << "        \"timed_out\": " << result.timed_out << ",\n"
+        << "        \"total_score\": " << result.total_score << ",\n"
+        << "        \"max_score\": " << result.max_score << ",\n"
+        << "        \"total_ticks\": " << result.total_ticks << ",\n"
+        << "        \"game_time_ms\": " << result.game_time_ms << ",\n"
+        << "        \"placements\": " << result.placements << ",\n"
+        << "        \"placement_retries\": " << result.placement_retries
+        << "\n"
+        << "      },\n"
+        << "      \"memory\": {\n"
+        << "        \"max_length\": " << result.max_length << ",\n"
+        << "        \"occupancy_bytes\": "
+        << result.occupancy_bytes / options.seed_count << ",\n"
+        << std::fixed
+        << std::setprecision(2)
+        << "        \"body_bytes_per_segment\": "
+        << result.body_bytes / segments << ",\n"
+        << "        \"state_bytes_per_segment\": "
+        << (result.body_bytes + result.occupancy_bytes) / segments << "\n"
+        << "      },\n"
+        << "      \"performance\": {\n"
+        << std::setprecision(0)
+        << "        \"ticks_per_second\": "
+        << (result.seconds > 0 ? ticks / result.seconds : 0) << ",\n"
+        << std::setprecision(1)
+        << "        \"ns_per_tick\": " << result.seconds * 1e9 / ticks
+        << ",\n"
+        << std::setprecision(4)
+        << "        \"allocations_per_tick\": ";
+
+#ifdef SNAKE2_COUNT_ALLOCATIONS
+    out << result.allocations / ticks;
+#else
+    out << "null";
+#endif
+
+    out << ",\n"
+        << "        \"retries_per_placement\": "
+        << result.placement_retries / placements << "\n"
+        << "      }\n"
+        << "    }";
+}
+
+/* \brief Play the seeded games of one rule variant and write their entry.
+ *
+ * \param[in] policy Autopilot policy.
+ * \param[in] rules Rule variant.
+ * \param[in] options Game set to play.
+ * \param[in,out] first True until the first entry has been written.
+ * \param[out] out Stream the entry is written to.
+ */
+void playAndWriteRun(Policy policy, const GameRules& rules,
+                     const TournamentOptions& options, bool& first,
+                     std::ostream& out) {
+    RunResult result = playRun(policy, rules, options);
+
+    if (!first)
+        out << ",\n";
+    writeRun(policy, rules, result, options, out);
+    first = false;
+}
+
+}  // namespace
+
+#ifdef SNAKE2_COUNT_ALLOCATIONS
+// Count every heap allocation so that runs can report allocations per tick
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    void* memory = std::malloc(size ? size : 1);
+    if (!memory)
+        throw std::bad_alloc();
+
+    return memory;
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+#endif  // SNAKE2_COUNT_ALLOCATIONS
+
+void runTournament(const TournamentOptions& options, std::ostream& out) {
+    const Policy policies[] = {Policy::RANDOM, Policy::GREEDY};
+    bool first = true;
+
+    out << "{\n"
+        << "  \"format\": 2,\n"
+        << "  \"seed_count\": " << options.seed_count << ",\n"
+        << "  \"tick_limit\": " << options.tick_limit << ",\n"
+        << "  \"runs\": [\n";
+
+    for (Policy policy : policies) {
+        for (int level = LEVEL_MIN; level <= LEVEL_MAX; level++) {
+            for (int size : options.board_sizes) {
+                for (bool wormhole : {false, true}) {
+                    GameRules rules;
+                    rules.width = size;
+                    rules.height = size;
+                    rules.wormhole = wormhole;
+                    rules.level = level;
+
+                    playAndWriteRun(policy, rules, options, first, out);
+                }
+            }
+        }
+    }
+
+    // Measure memory on snakes that fill part of each field from the start
+    out << "\n  ],\n"
+        << "  \"long_snake_runs\": [\n";
+    first = true;
+
+    for (int size : options.board_sizes) {
+        GameRules rules;
+        rules.width = size;
+        rules.height = size;
+        rules.wormhole = false;
+        rules.start_length = (int)(options.long_snake_fill * size * size);
+
+        playAndWriteRun(Policy::GREEDY, rules, options, first, out);
+    }
+
+    out << "\n  ]\n"
+        << "}\n";
+}
@@ -0,0 +1,61 @@
+/*
+####################################################################
+# TIE-02201 Ohjelmointi 2: Perusteet, K2019                        #
+# TIE-02207 Programming 2: Basics, S2019                           #
+#                                                                  #
+# Project4: Snake                                                  #
+#                                                                  #
+# File: tournament.hh                                              #
+# Description: Declares a headless bot tournament producing a      #
+#              regression report.                                  #
+#                                                                  #
+# Author: Timo Hartikainen, timo.hartikainen@tuni.fi               #
+####################################################################
+*/
+
+#ifndef PRG2_SNAKE2_TOURNAMENT_HH
+#define PRG2_SNAKE2_TOURNAMENT_HH
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+const std::string TOURNAMENT_ARGUMENT = "--tournament"; /**< Command line
+                                                             switch. */
+const std::string SEEDS_ARGUMENT = "--seeds";           /**< Number of seeds
+                                                             per run. */
+
+/* \struct TournamentOptions
+ * \brief Fixed game set played by a tournament.
+ */
+struct TournamentOptions {
+    std::vector<int> board_sizes = {20, 64, 256, 4096}; /**< Square field
+                                                             sides. */
+    int seed_count = 5;                 /**< Games per rule variant. */
+    long long tick_limit = 20000;       /**< Moves before a game times out. */
+    double long_snake_fill = 0.25;      /**< Field share taken by the Snake
+                                             at the start of long snake
+                                             runs. */
+};
+
+/* \brief Play every policy against every rule variant and write a report.
+ *
+ * The report is JSON with a fixed key order. Game outcomes depend only on
+ * the seeds, so two builds can be compared with a plain diff. Memory per
+ * snake part is reported both for the body alone and with the occupancy
+ * plane spread over the parts. Long snake runs start with a Snake filling
+ * part of the field so that those figures cover long snakes, too.
+ *
+ * Allocations per tick are reported only in builds defining
+ * SNAKE2_COUNT_ALLOCATIONS (qmake CONFIG+=count_allocations). Counting
+ * replaces the global operator new, which would also slow down every Qt
+ * allocation in normal play, so it is off by default and the report
+ * shows null instead.
+ *
+ * \param[in] options Game set to play.
+ * \param[out] out Stream the report is written to.
+ */
+void runTournament(const TournamentOptions& options, std::ostream& out);
+
+
+#endif  // PRG2_SNAKE2_TOURNAMENT_HH